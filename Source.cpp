@@ -11,10 +11,25 @@
 */
 
 /*  DESCRIPTION
-	This Deductive Fault Simulator can be used for 2 purposes:
+	This Deductive Fault Simulator can be used for 5 purposes:
 	1. To analyse the circuit by checking the faults detected for individual test vectors
 		Gives a list of faults detected and the fault coverage for the given inputs.
 	2. To find out the number of test vectors required to achieve a given fault coverage
+		The progress can be saved every few test vectors to <filename>.chk, and a stopped run can be resumed from it
+		with the same result as an uninterrupted run.
+	3. To re-simulate a set of test vectors after editing a few gates (ECO)
+		The results of every test vector are saved to <filename>.sim and reused as long as the test vectors are the same.
+		The gate edits are read from a file with one edit per line:
+			ADD <gate> <inputs> <output>, REMOVE <output>, RETYPE <output> <gate> or REWIRE <output> <inputs>
+		Only the fanout cones of the edited gates are simulated again. The faults detected and lost by every test vector
+		and the change in fault coverage are reported, and the edited circuit is saved as <filename>_eco.
+	4. To fault grade a functional input sequence on a sequential circuit
+		Each input vector in the sequence file is applied for one clock cycle, starting from the given state of the
+		flip-flops. The values and fault lists at the D inputs are carried to the Q outputs in the next cycle.
+	5. To run many jobs in one go from a manifest file
+		Each line of the manifest is a job: <filename> <fault locations (1-5)> <input vector file | random:<count>>.
+		Every circuit is read once and shared by its jobs, which run on a pool of threads. The faults detected by
+		every job are reported in BatchReport.txt.
 
 	For every location, both s-a-0 and s-s-1 faults are considered. The fault locations can be chosen in 5 different ways:
 	1. At Primary inputs.
@@ -22,6 +37,15 @@
 	3. At Gate outputs.
 	4. At Primary inputs and Primary outputs.
 	5. At Primary inputs, Primary outputs and Gate outputs.
+
+	In cases 1 and 2 a memory budget can be given for the fault lists. The size of the fault lists is estimated from
+	the fanin cones of the nodes, and the fault locations are split into as many passes as needed to stay within it.
+	Every test vector is simulated once per pass and the faults detected by the passes are merged.
+
+	Each line of the circuit file is a gate followed by its input nodes and then its output node. AND, NAND, OR, NOR,
+	XOR and XNOR gates can have any number of inputs, INV and BUF have one. A line DFF <D> <Q> is a D flip-flop.
+	In cases 1, 2 and 3 the flip-flops are scanned: the Q nodes follow the PIs in the input vector, and the D nodes
+	are observed along with the POs.
 */
 
 /*  STEPS
@@ -36,16 +60,22 @@
 #include <string>
 #include <algorithm>
 #include <vector>
+#include <iterator>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <thread>
+#include <mutex>
 
 using namespace std;
 
 struct Gates
 {
-	string	gateType;
-	int		gateNumber;
-	int		gateInput1, gateInput2;
-	int		gateOutput;
-	int		gateFlag;
+	string			gateType;
+	int				gateNumber;
+	vector <int>	gateInputs;
+	int				gateOutput;
 }G;
 
 struct Nodes
@@ -55,38 +85,52 @@ struct Nodes
 	int				SAvalue0;
 	int				SAvalue1;
 	vector <int>	nodeErrorList;
-	vector <Gates>	listofGates;
 }N;
 
-ofstream outputFile;
-
-int no_spaces1 = 0;
-int faultCount = 0;										// Number of faults
-
-float expFaultCoverage = 0;								// The needed fault coverage
+struct Snapshots
+{
+	string			inputVector;
+	string			nodeValues;					// Value (0/1) of every node
+	vector <int>	errorListStart;				// Where the fault list of every node starts in nodeErrorLists, the last entry is the end
+	vector <int>	nodeErrorLists;				// Fault lists of all the nodes, one after the other
+}S;
 
-string inputValues = "";								// Input test vector when manually entering the test case
+struct Circuits
+{
+	string					circuitName;				// Name of the circuit file without .txt
+	unsigned int			netlistHash;				// Fingerprint of the circuit file
+	vector <Gates>			Gate;
+	vector <Gates>			FlipFlop;					// D flip-flops, with the D node as the input and the Q node as the output
+	vector <int>			PINodes;					// List of primary input nodes
+	vector <int>			PONodes;					// List of primary output nodes
+	vector <int>			GONodes;					// List of gate output nodes
+	vector < vector <int> >	listofGates;				// List of gates using each node as an input
+}C;
+
+struct Jobs
+{
+	string		netlist;										// Circuit file without .txt
+	int			faultChoice;									// Fault locations, as in SAFaultList()
+	string		patterns;										// Input vector file without .txt, or random:<count>
+	int			flag;											// Result of the job
+	int			vectorCount;
+	int			faultsDetected;
+	int			faultCount;
+	Circuits	*circuit;										// Shared by the jobs on the same circuit
+}J;
 
-vector <Gates> Gate;
-vector <Nodes> Node;
-vector <Gates> Temp;
-vector <int>   PINodes;									// List of primary input nodes
-vector <int>   PONodes;									// List of primary output nodes
-vector <int>   GONodes;									// List of gate output nodes
-vector <int>   faultList;								// List of faults
+ofstream outputFile;
 
 class DeductiveFM
 {
 public:
-	DeductiveFM();
+	DeductiveFM(Circuits &circuit);
 	~DeductiveFM();
 
 	// Reads the circuit file
 	int readCircuitFile(int choice)
 	{
-		int no_spaces	= 0;												// Number of spaces in each line
-		int lineCount	= 0;												// Number of the line being read
-		int i			= 0;												// Control variable
+		int flag = 1;
 
 		string fileName	   = "";											// Name of the file containing the interconnection
 		string line		   = "";											// Each line in the file
@@ -95,9 +139,7 @@ public:
 		cout << endl << "Enter the filename here: ";
 		cin  >> fileName;
 
-		fileName += ".txt";
-
-		ifstream inputFile(fileName);										// Opens the file containing the interconnection
+		ifstream inputFile(fileName + ".txt");								// Opens the file containing the interconnection
 
 		// Displaying all the contents of the file
 	    if(inputFile.is_open())
@@ -109,150 +151,190 @@ public:
 		else
 			return 0;
 
-		inputFile.open(fileName);
+		flag = parseCircuitFile(fileName, choice);
+		if (flag != 1)
+			return flag;
+
+		cout << endl << endl;
+
+		// Choice 1: Individual Analysis
+		if (choice == 1)
+		{
+			cout << "Input Vector (" << PINodes.size() << " inputs): ";
+			cin  >> inputValues;
 
-		// Tokenizing and storing all the contents of the file
-		if (inputFile.is_open())
+			if (inputValues.length() != PINodes.size())
+				return 2;
+		}
+		// Choice 2: Fault Coverage
+		else if (choice == 2)
 		{
-			while (getline(inputFile, line))
+			// Expected fault coverage
+			cout << "What is the expected fault coverage?" << endl;
+			cin  >> expFaultCoverage;
+
+			if (expFaultCoverage >= 100)
+				return 3;
+
+			// Generating a random input
+			for (int i = 0; i < PINodes.size(); i++)
+				inputValues += ((rand() % 2) + 48);
+		}
+
+		// Assigning values to Input nodes, for choices 3 and 4 the input vectors are read later
+		if (choice == 1 || choice == 2)
+			for (int i = 0; i < PINodes.size(); i++)
 			{
-				no_spaces = std::count(line.begin(), line.end(), ' ');
+				Node.at(PINodes.at(i)).nodeValue = (int) (inputValues[i] - 48);
+				Node.at(PINodes.at(i)).nodeFlag = 1;			                        // Flag indicating that the node has been assigned a value
+			}
+
+		return 1;
+	}
+
+	// Tokenizes and stores the circuit file, the flip-flops are scanned unless the choice is 4
+	int parseCircuitFile(string fileName, int choice)
+	{
+		int no_spaces	= 0;												// Number of spaces in each line
+		int i			= 0;												// Control variable
 
-				string *subString = new string[no_spaces + 1];							// Sub string in each line
-				istringstream iss(line);
+		string line		   = "";											// Each line in the file
 
-				i = 0;
+		circuitName = fileName;
+		netlistHash = 2166136261u;
 
-				// Tokenizing each line into sub strings
-				while (iss && i <= no_spaces)
-				{
-					string sub;
-					iss >> sub;
-					subString[i] = sub;
-					i++;
-				}
+		ifstream inputFile(fileName + ".txt");								// Opens the file containing the interconnection
 
-				G.gateType		= subString[0];							// Name of the gate
-				G.gateNumber	= lineCount;							// Number of the gate
+		if (!inputFile.is_open())
+			return 0;
 
-				// Reading all lines except inputs and outputs
-				if (G.gateType != "INPUT" && G.gateType != "OUTPUT")
-				{
-					G.gateInput1 = atoi(subString[1].c_str());							// Input 1 of the gate
+		while (getline(inputFile, line))
+		{
+			hashLine(line);													// Fingerprinting the circuit for the checkpoints
 
-					// Total number of input nodes till gate input 1
-					while (Node.size() <= G.gateInput1)
-						Node.push_back(N);
+			no_spaces = std::count(line.begin(), line.end(), ' ');
 
-					Node.at(G.gateInput1).listofGates.push_back(G);						// List of gates at each node using gate input 1
+			string *subString = new string[no_spaces + 1];							// Sub string in each line
+			istringstream iss(line);
 
-					// Reading all lines except INV and BUF
-					if (G.gateType != "INV" && G.gateType != "BUF")
-					{
-						G.gateInput2 = atoi(subString[2].c_str());						// Input 2 of the gate
-						G.gateOutput = atoi(subString[3].c_str());						// Output of the double-input gate
+			i = 0;
 
-						GONodes.push_back(G.gateOutput);
+			// Tokenizing each line into sub strings
+			while (iss && i <= no_spaces)
+			{
+				string sub;
+				iss >> sub;
+				subString[i] = sub;
+				i++;
+			}
 
-						// Total number of input nodes till gate input 2
-						while (Node.size() <= G.gateInput2)
-							Node.push_back(N);
+			// Skipping empty lines
+			if (subString[0] == "")
+				continue;
 
-						Node.at(G.gateInput2).listofGates.push_back(G);					// List of gates at each node using gate input 2
-					}
-					else
-					{
-						G.gateOutput = atoi(subString[2].c_str());						// Output of the single-input gate
+			G.gateType		= subString[0];							// Name of the gate
+			G.gateNumber	= Gate.size();							// Number of the gate
 
-						GONodes.push_back(G.gateOutput);
-					}						
+			// Reading all lines except inputs and outputs
+			if (G.gateType != "INPUT" && G.gateType != "OUTPUT")
+			{
+				G.gateInputs.clear();
 
-					Gate.push_back(G);
+				// The last node is the output, all the others are inputs
+				for (int i = 1; i <= no_spaces; i++)
+					if (subString[i] != "")
+						G.gateInputs.push_back(atoi(subString[i].c_str()));
+
+				if (G.gateInputs.size() < 2 || (!validInputs(G.gateType, G.gateInputs.size() - 1) && !(G.gateType == "DFF" && G.gateInputs.size() == 2)))
+					return 4;
+
+				G.gateOutput = G.gateInputs.back();					// Output of the gate
+				G.gateInputs.pop_back();
+
+				// Flip-flops are kept apart from the combinational gates
+				if (G.gateType == "DFF")
+				{
+					addNode(max(G.gateOutput, G.gateInputs.at(0)));
+
+					FlipFlop.push_back(G);
 				}
 				else
 				{
-					// Reading the INPUTS line
-					if (G.gateType == "INPUT")
-					{
-						no_spaces1 = no_spaces;
-						cout << endl << endl;
-
-						// Choice 1: Individual Analysis
-						if (choice == 1)
-						{
-							cout << "Input Vector (" << (no_spaces - 2) << " inputs): ";
-							cin  >> inputValues;
-
-							if (inputValues.length() != (no_spaces - 2))
-								return 2;
-
-							// Assigning values to Input nodes
-							for (int i = 1; i < (no_spaces - 1); i++)
-							{
-								Node.at(atoi(subString[i].c_str())).nodeValue = (int) (inputValues[i-1] - 48);
-								Node.at(atoi(subString[i].c_str())).nodeFlag = 1;			                        // Flag indicating that the node has been assigned a value
-
-								PINodes.push_back(atoi(subString[i].c_str()));										// List of PI nodes
-							}
-						}
-						// Choice 2: Fault Coverage
-						else if (choice == 2)
-						{
-							// Expected fault coverage
-							cout << "What is the expected fault coverage?" << endl;
-							cin  >> expFaultCoverage;
-
-							if (expFaultCoverage >= 100)
-								return 3;
-
-							// Generating a random input
-							for (int i = 1; i < (no_spaces - 1); i++)
-								inputValues += ((rand() % 2) + 48);
-
-							// Assigning values to Input nodes
-							for (int i = 1; i < (no_spaces - 1); i++)
-							{
-								Node.at(atoi(subString[i].c_str())).nodeValue = (int) (inputValues[i-1] - 48);
-								Node.at(atoi(subString[i].c_str())).nodeFlag = 1;			                        // Flag indicating that the node has been assigned a value
-
-								PINodes.push_back(atoi(subString[i].c_str()));										// List of PI nodes
-							}
-						}
-						else
-						{
-							cout << endl << "Incorrect choice!";
-							return 0;
-						}
-					}
+					GONodes.push_back(G.gateOutput);
 
-					// Reading the OUTPUTS line
-					if (G.gateType == "OUTPUT")
+					// Total number of nodes till the gate inputs and output
+					for (int i = 0; i < G.gateInputs.size(); i++)
 					{
-						for (int i = 1; i < (no_spaces - 1) ; i++)
-							PONodes.push_back(atoi(subString[i].c_str()));			// List of PO nodes
+						addNode(G.gateInputs.at(i));
 
-						for (int i = 0; i < PONodes.size(); i++)
-							while (Node.size() <= PONodes.at(i))
-								Node.push_back(N);
-						break;
+						listofGates.at(G.gateInputs.at(i)).push_back(G.gateNumber);		// List of gates at each node using it as an input
 					}
+
+					addNode(G.gateOutput);
+
+					Gate.push_back(G);
+				}
+			}
+
+			// Reading the INPUTS line
+			else if (G.gateType == "INPUT")
+			{
+				for (int i = 1; i < (no_spaces - 1); i++)
+					PINodes.push_back(atoi(subString[i].c_str()));										// List of PI nodes
+
+				// The flip-flop outputs are pseudo PIs for scan tests, and gate outputs over clock cycles
+				for (int i = 0; i < FlipFlop.size(); i++)
+				{
+					if (choice == 4)
+						GONodes.push_back(FlipFlop.at(i).gateOutput);
+					else
+						PINodes.push_back(FlipFlop.at(i).gateOutput);
 				}
+			}
+
+			// Reading the OUTPUTS line
+			else
+			{
+				for (int i = 1; i < (no_spaces - 1) ; i++)
+					PONodes.push_back(atoi(subString[i].c_str()));			// List of PO nodes
 
-				no_spaces = 0;
-				lineCount++;
+				// The flip-flop inputs are pseudo POs for scan tests
+				if (choice != 4)
+					for (int i = 0; i < FlipFlop.size(); i++)
+						PONodes.push_back(FlipFlop.at(i).gateInputs.at(0));
+
+				for (int i = 0; i < PONodes.size(); i++)
+					addNode(PONodes.at(i));
+				break;
 			}
 
-	        inputFile.close();							// Close the file containing the interconnection
+			no_spaces = 0;
 		}
 
+        inputFile.close();							// Close the file containing the interconnection
+
+		gateFlag.assign(Gate.size(), 0);
+
 		return 1;
 	}
 
+	// Makes room for the nodes up to the given node
+	void addNode(int node)
+	{
+		while (Node.size() <= node)
+			Node.push_back(N);
+
+		while (listofGates.size() <= node)
+			listofGates.push_back(vector <int> ());
+	}
+
 	// Creates the fault list
 	int SAFaultList(int choice)
 	{
 		int errorNodeValue = 0;												// l in l s-a-v
 
+		faultChoice = choice;
+
 		// PIs
 		if (choice == 1)
 		{
@@ -306,6 +388,8 @@ public:
 	// Assigns the l s-a-vs
 	void assignFaults(int errorNodeValue)
 	{
+		faultSites.push_back(errorNodeValue);
+
 		Node.at(errorNodeValue).SAvalue0 = errorNodeValue * 10 + 0;
 
 		if (Node.at(errorNodeValue).nodeFlag == 1)																// Checking if the node has a value
@@ -319,6 +403,117 @@ public:
 				Node.at(errorNodeValue).nodeErrorList.push_back(Node.at(errorNodeValue).SAvalue1);				// Changing the node value to the stuck at value
 	}
 
+	// Splits the fault locations into as many passes as needed to keep the fault lists within the budget (in KB)
+	// With several passes case 1 keeps the merged PO fault lists for the report, so they count at their full size
+	void planPasses(int budget, int choice)
+	{
+		vector <int> order;
+		vector <int> coneFaults(Node.size(), 0);						// Upper bound on the fault list size at each node
+		vector <int> isSite(Node.size(), 0);
+
+		sort(faultSites.begin(), faultSites.end());
+		faultSites.erase(unique(faultSites.begin(), faultSites.end()), faultSites.end());
+
+		faultPasses = 1;
+
+		if (budget <= 0 || faultSites.size() == 0)
+			return;
+
+		for (int i = 0; i < faultSites.size(); i++)
+			isSite.at(faultSites.at(i)) = 2;
+
+		// A fault list can only hold the faults in the fanin cone of its node
+		for (int i = 0; i < PINodes.size(); i++)
+			coneFaults.at(PINodes.at(i)) = isSite.at(PINodes.at(i));
+
+		levelizeGates(order);
+
+		for (int i = 0; i < order.size(); i++)
+		{
+			int out = Gate.at(order.at(i)).gateOutput;
+
+			coneFaults.at(out) = isSite.at(out);
+			for (int j = 0; j < Gate.at(order.at(i)).gateInputs.size(); j++)
+				coneFaults.at(out) = min(coneFaults.at(out) + coneFaults.at(Gate.at(order.at(i)).gateInputs.at(j)), faultCount);
+		}
+
+		double footprint = 0;											// Estimated size of the fault lists in the largest pass
+
+		// Adding passes until the largest pass fits
+		while (true)
+		{
+			int passFaults = 2 * ((faultSites.size() + faultPasses - 1) / faultPasses);
+
+			footprint = 0;
+			for (int i = 0; i < Node.size(); i++)
+				footprint += min(coneFaults.at(i), passFaults) * sizeof(int);
+
+			if (choice == 1 && faultPasses > 1)
+				for (int i = 0; i < PONodes.size(); i++)
+					footprint += coneFaults.at(PONodes.at(i)) * sizeof(int);
+
+			if (footprint <= budget * 1024.0 || faultPasses >= faultSites.size())
+				break;
+
+			faultPasses++;
+		}
+
+		cout << endl << "The faults are simulated in " << faultPasses << " pass(es)";
+
+		if (footprint > budget * 1024.0)
+			cout << endl << "Warning: the fault lists need about " << (int) ((footprint + 1023) / 1024) << " KB even with one fault location per pass, over the budget of " << budget << " KB";
+	}
+
+	// Keeps only the fault locations of one pass
+	void selectFaultPass(int pass)
+	{
+		int passSites = (faultSites.size() + faultPasses - 1) / faultPasses;
+
+		for (int i = 0; i < faultSites.size(); i++)
+		{
+			if (i / passSites == pass)
+			{
+				Node.at(faultSites.at(i)).SAvalue0 = faultSites.at(i) * 10 + 0;
+				Node.at(faultSites.at(i)).SAvalue1 = faultSites.at(i) * 10 + 1;
+			}
+			else
+			{
+				Node.at(faultSites.at(i)).SAvalue0 = 0;
+				Node.at(faultSites.at(i)).SAvalue1 = 0;
+			}
+		}
+	}
+
+	// Orders the gates so that every gate comes after the gates driving its inputs
+	void levelizeGates(vector <int> &order)
+	{
+		vector <int> driven(Node.size(), 0);
+		vector <int> pending(Gate.size(), 0);							// Inputs of each gate not yet ordered
+
+		order.clear();
+
+		for (int i = 0; i < Gate.size(); i++)
+			driven.at(Gate.at(i).gateOutput) = 1;
+
+		for (int i = 0; i < Gate.size(); i++)
+		{
+			for (int j = 0; j < Gate.at(i).gateInputs.size(); j++)
+				pending.at(i) += driven.at(Gate.at(i).gateInputs.at(j));
+
+			if (pending.at(i) == 0)
+				order.push_back(i);
+		}
+
+		for (int i = 0; i < order.size(); i++)
+		{
+			int out = Gate.at(order.at(i)).gateOutput;
+
+			for (int j = 0; j < listofGates.at(out).size(); j++)
+				if (--pending.at(listofGates.at(out).at(j)) == 0)
+					order.push_back(listofGates.at(out).at(j));
+		}
+	}
+
 	// Creates the output file for case 1
 	int createOutputFile()
 	{
@@ -375,27 +570,17 @@ public:
 				}
 
 				for (int i = 0; i < Gate.size(); i++)
-					Gate.at(i).gateFlag = 0;
+					gateFlag.at(i) = 0;
 
-				cout << endl << "Input Vector (" << (no_spaces1 - 2) << " inputs): ";
+				cout << endl << "Input Vector (" << PINodes.size() << " inputs): ";
 				cin  >> inputValues;
 
-				if (inputValues.length() != (no_spaces1 - 2))
+				if (inputValues.length() != PINodes.size())
 					return 0;
 
 				inputVectorCount++;
 
-				for (int i = 0; i < (no_spaces1 - 2); i++)
-				{
-					Node.at(PINodes.at(i)).nodeValue = (int)(inputValues[i] - 48);
-					Node.at(PINodes.at(i)).nodeFlag = 1;
-
-					if (PINodes.at(i) * 10 + Node.at(PINodes.at(i)).nodeValue != Node.at(PINodes.at(i)).SAvalue0)
-						Node.at(PINodes.at(i)).nodeErrorList.push_back(Node.at(PINodes.at(i)).SAvalue0);
-
-					if (PINodes.at(i) * 10 + Node.at(PINodes.at(i)).nodeValue != Node.at(PINodes.at(i)).SAvalue1)
-						Node.at(PINodes.at(i)).nodeErrorList.push_back(Node.at(PINodes.at(i)).SAvalue1);
-				}
+				applyInputVector();
 			}
 		}
 
@@ -404,52 +589,48 @@ public:
 	}
 
 	// Creates the output file for case 2
-	void createOutputFile_FC()
+	int createOutputFile_FC(int checkpointInterval, int resume)
 	{
 		int inputVectorCount = 1;
 		int coverage		 = 0;
+		int flag			 = 1;
 
 		outputFile.open("Outputs.txt");                         // Creating the output file
 
-		while (coverage < expFaultCoverage)
+		// Continuing from the state saved by an earlier run
+		if (resume == 1)
 		{
-			calculateOutputs();
-
-			sort(faultList.begin(), faultList.end());
-			faultList.erase(unique(faultList.begin(), faultList.end()), faultList.end());
+			flag = restoreCheckpoint(inputVectorCount);
+			if (flag != 1)
+				return flag;
 
 			coverage = (faultList.size() * 100) / faultCount;
 
 			if (coverage < expFaultCoverage)
 			{
-				for (int i = 0; i < Node.size(); i++)
-				{
-					Node.at(i).nodeFlag = 0;
-					Node.at(i).nodeErrorList.clear();
-				}
-
-				for (int i = 0; i < Gate.size(); i++)
-					Gate.at(i).gateFlag = 0;
-
 				inputVectorCount++;
+				nextRandomVector();
+			}
+		}
 
-				inputValues = "";
+		while (coverage < expFaultCoverage)
+		{
+			calculateOutputs();
 
-				// Generating a random input
-				for (int i = 1; i < (no_spaces1 - 1); i++)
-					inputValues += ((rand() % 2) + 48);
+			coverage = (faultList.size() * 100) / faultCount;
 
-				for (int i = 0; i < (no_spaces1 - 2); i++)
-				{
-					Node.at(PINodes.at(i)).nodeValue = (int)(inputValues[i] - 48);
-					Node.at(PINodes.at(i)).nodeFlag = 1;
+			if (checkpointInterval > 0)
+			{
+				hashLine(inputValues, vectorHash);
 
-					if (PINodes.at(i) * 10 + Node.at(PINodes.at(i)).nodeValue != Node.at(PINodes.at(i)).SAvalue0)
-						Node.at(PINodes.at(i)).nodeErrorList.push_back(Node.at(PINodes.at(i)).SAvalue0);
+				if (inputVectorCount % checkpointInterval == 0)
+					saveCheckpoint(inputVectorCount);
+			}
 
-					if (PINodes.at(i) * 10 + Node.at(PINodes.at(i)).nodeValue != Node.at(PINodes.at(i)).SAvalue1)
-						Node.at(PINodes.at(i)).nodeErrorList.push_back(Node.at(PINodes.at(i)).SAvalue1);
-				}
+			if (coverage < expFaultCoverage)
+			{
+				inputVectorCount++;
+				nextRandomVector();
 			}
 		}
 
@@ -457,273 +638,1532 @@ public:
 		outputFile << endl << "Fault Coverage = " << coverage;
 		cout << endl << "No. of inputs applied = " << inputVectorCount;
 		outputFile << endl << "No. of inputs applied = " << inputVectorCount;
+
+		return 1;
 	}
 
-	// Displays the final outputs for Case 1
-	void displayOutputs()
+	// Clears the previous simulation and applies a new random input vector
+	void nextRandomVector()
 	{
-		while (checkOutputValue(PONodes) != 1)
-			for (int i = 0 ; i < Gate.size() ; i++)
-				if (Gate.at(i).gateFlag != 1)
-					checkOutput(i);
-
-		for (int i = 0; i < PONodes.size(); i++)
+		for (int i = 0; i < Node.size(); i++)
 		{
-			if (Node.at(PONodes.at(i)).nodeErrorList.size())
-			{
-				cout << endl << "The faults propagated at the node " << PONodes.at(i) << " are: ";
-				outputFile << endl << "The faults propagated at the node " << PONodes.at(i) << " are: ";
-			}
+			Node.at(i).nodeFlag = 0;
+			Node.at(i).nodeErrorList.clear();
+		}
 
-			for (int j = 0; j < Node.at(PONodes.at(i)).nodeErrorList.size(); j++)
-			{
-				cout << Node.at(PONodes.at(i)).nodeErrorList.at(j)/10 << " s-a " << Node.at(PONodes.at(i)).nodeErrorList.at(j)%10 << " , ";
-				outputFile << Node.at(PONodes.at(i)).nodeErrorList.at(j)/10 << " s-a " << Node.at(PONodes.at(i)).nodeErrorList.at(j)%10 << " , ";
+		for (int i = 0; i < Gate.size(); i++)
+			gateFlag.at(i) = 0;
 
-				faultList.push_back(Node.at(PONodes.at(i)).nodeErrorList.at(j));
-			}
+		inputValues = "";
 
-			if (Node.at(PONodes.at(i)).nodeErrorList.size())
-			{
-				cout << "\b\b ";
-				outputFile << "b\b ";
-			}
-		}
+		// Generating a random input
+		for (int i = 0; i < PINodes.size(); i++)
+			inputValues += ((rand() % 2) + 48);
+
+		applyInputVector();
 	}
 
-	// Calculate outputs for Case 2
-	void calculateOutputs()
+	// Assigns inputValues to the PIs along with their faults
+	void applyInputVector()
 	{
-		while (checkOutputValue(PONodes) != 1)
-			for (int i = 0 ; i < Gate.size() ; i++)
-				if (Gate.at(i).gateFlag != 1)
-					checkOutput(i);
+		for (int i = 0; i < PINodes.size(); i++)
+		{
+			Node.at(PINodes.at(i)).nodeValue = (int)(inputValues[i] - 48);
+			Node.at(PINodes.at(i)).nodeFlag = 1;
 
-		for (int i = 0; i < PONodes.size(); i++)
-			for (int j = 0; j < Node.at(PONodes.at(i)).nodeErrorList.size(); j++)
-				faultList.push_back(Node.at(PONodes.at(i)).nodeErrorList.at(j));
+			if (Node.at(PINodes.at(i)).SAvalue0 > 0)
+				if (PINodes.at(i) * 10 + Node.at(PINodes.at(i)).nodeValue != Node.at(PINodes.at(i)).SAvalue0)
+					Node.at(PINodes.at(i)).nodeErrorList.push_back(Node.at(PINodes.at(i)).SAvalue0);
+
+			if (Node.at(PINodes.at(i)).SAvalue1 > 0)
+				if (PINodes.at(i) * 10 + Node.at(PINodes.at(i)).nodeValue != Node.at(PINodes.at(i)).SAvalue1)
+					Node.at(PINodes.at(i)).nodeErrorList.push_back(Node.at(PINodes.at(i)).SAvalue1);
+		}
 	}
 
-	// Checks if the POs have values assigned
-	int checkOutputValue(vector <int> outputNode)
+	// Adds a line of the circuit file to the fingerprint (FNV-1a)
+	void hashLine(string line)
 	{
-		int a = 0;
+		hashLine(line, netlistHash);
+	}
 
-		for (int i = 0; i < outputNode.size(); i++)
+	// Adds a line to the given fingerprint (FNV-1a)
+	void hashLine(string line, unsigned int &hash)
+	{
+		line += '\n';
+
+		for (int i = 0; i < line.length(); i++)
 		{
-			a = outputNode.at(i);
-			if (Node.at(a).nodeFlag != 1)
-				return 0;
+			hash ^= (unsigned char) line[i];
+			hash *= 16777619u;
 		}
-
-		return 1;
 	}
 
-	// Evaluates every gate
-	void checkOutput(int a)
+	// Saves the progress of case 2 to <circuit>.chk
+	void saveCheckpoint(int inputVectorCount)
 	{
-		if (Gate.at(a).gateType == "INV" || Gate.at(a).gateType == "BUF")
-		{
-			if (Node.at(Gate.at(a).gateInput1).nodeFlag == 1 && Gate.at(a).gateFlag != 1)
-			{
-				Gate.at(a).gateFlag = 1;
-
-				if (Gate.at(a).gateType == "INV")
-				{
-					Node.at(Gate.at(a).gateOutput).nodeValue = !(Node.at(Gate.at(a).gateInput1).nodeValue);
-					Node.at(Gate.at(a).gateOutput).nodeFlag = 1;
-
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.reserve(Node.at(Gate.at(a).gateOutput).nodeErrorList.size() + Node.at(Gate.at(a).gateInput1).nodeErrorList.size() + 1);
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.insert(Node.at(Gate.at(a).gateOutput).nodeErrorList.end(),Node.at(Gate.at(a).gateInput1).nodeErrorList.begin(),Node.at(Gate.at(a).gateInput1).nodeErrorList.end());
+		string fileName = circuitName + ".chk";
+		string tempName = fileName + ".tmp";
 
-					if (Node.at(Gate.at(a).gateOutput).SAvalue0 > 0)
-						if ((Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue) != Node.at(Gate.at(a).gateOutput).SAvalue0)
-							Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue0);
-
-					if (Node.at(Gate.at(a).gateOutput).SAvalue1 > 0)
-						if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue1)
-							Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue1);
-				}
+		ofstream checkpointFile(tempName);
 
-				else
-				{
-					Node.at(Gate.at(a).gateOutput).nodeValue = Node.at(Gate.at(a).gateInput1).nodeValue;
-					Node.at(Gate.at(a).gateOutput).nodeFlag = 1;
+		if (!checkpointFile.is_open())
+			return;
 
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.reserve(Node.at(Gate.at(a).gateOutput).nodeErrorList.size() + Node.at(Gate.at(a).gateInput1).nodeErrorList.size() + 1);
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.insert(Node.at(Gate.at(a).gateOutput).nodeErrorList.end(),Node.at(Gate.at(a).gateInput1).nodeErrorList.begin(),Node.at(Gate.at(a).gateInput1).nodeErrorList.end());
+		checkpointFile.precision(9);									// Enough digits to read the target back unchanged
 
-					if (Node.at(Gate.at(a).gateOutput).SAvalue0 > 0)
-						if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue0)
-							Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue0);
+		checkpointFile << "DFS_CHECKPOINT" << endl;
+		checkpointFile << netlistHash << " " << faultChoice << " " << faultCount << " " << PINodes.size() << " " << expFaultCoverage << endl;
+		checkpointFile << inputVectorCount << " " << vectorHash << " " << faultList.size() << endl;
 
-					if (Node.at(Gate.at(a).gateOutput).SAvalue1 > 0)
-						if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue1)
-							Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue1);
-				}
+		for (int i = 0; i < faultList.size(); i++)
+			checkpointFile << faultList.at(i) << " ";
+		checkpointFile << endl;
 
-				checkNode(Gate.at(a).gateOutput);
-			}
-		}
+		checkpointFile.close();
 
-		else
+		// Keeping the old checkpoint if the new one could not be written completely
+		if (!checkpointFile)
 		{
-			if (Node.at(Gate.at(a).gateInput1).nodeFlag == 1 && Node.at(Gate.at(a).gateInput2).nodeFlag == 1 && Gate.at(a).gateFlag != 1)
-			{
-				Gate.at(a).gateFlag = 1;
+			remove(tempName.c_str());
+			return;
+		}
 
-				if (Gate.at(a).gateType == "AND")
-				{
-					Node.at(Gate.at(a).gateOutput).nodeValue = Node.at(Gate.at(a).gateInput1).nodeValue & Node.at(Gate.at(a).gateInput2).nodeValue;
-					Node.at(Gate.at(a).gateOutput).nodeFlag = 1;
+		// rename() replaces the old checkpoint in one step, except on Windows where it cannot overwrite
+#ifdef _WIN32
+		remove(fileName.c_str());
+#endif
+		rename(tempName.c_str(), fileName.c_str());
+	}
 
-					errorList(a, 0);								// Output node of gate, controlling variable of Gate
-				}
+	// Restores the progress of case 2 from <circuit>.chk
+	int restoreCheckpoint(int &inputVectorCount)
+	{
+		string		 header	= "";
+		unsigned int hash	= 0, vectors = 0;
+		int			 choice = 0, count = 0, inputs = 0, faults = 0;
+		float		 target = 0;
 
-				else if (Gate.at(a).gateType == "NAND")
-				{
-					Node.at(Gate.at(a).gateOutput).nodeValue = !(Node.at(Gate.at(a).gateInput1).nodeValue & Node.at(Gate.at(a).gateInput2).nodeValue);
-					Node.at(Gate.at(a).gateOutput).nodeFlag = 1;
+		ifstream checkpointFile(circuitName + ".chk");
 
-					errorList(a, 0);								// Output node of gate, controlling variable of Gate
-				}
+		if (!checkpointFile.is_open())
+			return 0;
 
-				else if (Gate.at(a).gateType == "OR")
-				{
-					Node.at(Gate.at(a).gateOutput).nodeValue = Node.at(Gate.at(a).gateInput1).nodeValue | Node.at(Gate.at(a).gateInput2).nodeValue;
-					Node.at(Gate.at(a).gateOutput).nodeFlag = 1;
+		checkpointFile >> header >> hash >> choice >> count >> inputs >> target;
 
-					errorList(a, 1);								// Output node of gate, controlling variable of Gate
-				}
+		// The checkpoint must belong to the same circuit, fault universe and fault coverage target
+		if (header != "DFS_CHECKPOINT" || hash != netlistHash || choice != faultChoice || count != faultCount || inputs != PINodes.size() || target != expFaultCoverage)
+			return 2;
 
-				else if (Gate.at(a).gateType == "NOR")
-				{
-					Node.at(Gate.at(a).gateOutput).nodeValue = !(Node.at(Gate.at(a).gateInput1).nodeValue | Node.at(Gate.at(a).gateInput2).nodeValue);
-					Node.at(Gate.at(a).gateOutput).nodeFlag = 1;
+		checkpointFile >> inputVectorCount >> vectors >> faults;
 
-					errorList(a, 1);								// Output node of gate, controlling variable of Gate
-				}
+		// Rejecting a damaged checkpoint instead of trusting its counts
+		if (!checkpointFile || inputVectorCount < 1 || faults < 0 || faults > faultCount)
+			return 2;
 
-				checkNode(Gate.at(a).gateOutput);
-			}
-		}
-	}
+		faultList.resize(faults);
+		for (int i = 0; i < faults; i++)
+			checkpointFile >> faultList.at(i);
 
-	// Propagates the values at every node
-	void checkNode(int a)
-	{
-		for (int i = 0 ; i < Node.at(a).listofGates.size() ; i++)
-		{
-			Temp = Node.at(a).listofGates;
-			if (Gate.at(Temp.at(i).gateNumber).gateFlag != 1)
-				checkOutput(Temp.at(i).gateNumber);
-		}
-	}
+		if (!checkpointFile)
+			return 2;
 
-	// Propagates faults from gate inputs to outputs based on the controlling values
-	void errorList(int a, int c)
-	{
-		if (Node.at(Gate.at(a).gateInput1).nodeValue != c && Node.at(Gate.at(a).gateInput2).nodeValue != c)
+		// Bringing rand() to the same state by regenerating the applied vectors, checked against their fingerprint
+		hashLine(inputValues, vectorHash);
+		for (int i = 1; i < inputVectorCount; i++)
 		{
-			Node.at(Gate.at(a).gateOutput).nodeErrorList.reserve(Node.at(Gate.at(a).gateOutput).nodeErrorList.size() + Node.at(Gate.at(a).gateInput1).nodeErrorList.size() + Node.at(Gate.at(a).gateInput2).nodeErrorList.size() + 1);
-			Node.at(Gate.at(a).gateOutput).nodeErrorList.insert(Node.at(Gate.at(a).gateOutput).nodeErrorList.end(),Node.at(Gate.at(a).gateInput1).nodeErrorList.begin(),Node.at(Gate.at(a).gateInput1).nodeErrorList.end());
-			Node.at(Gate.at(a).gateOutput).nodeErrorList.insert(Node.at(Gate.at(a).gateOutput).nodeErrorList.end(),Node.at(Gate.at(a).gateInput2).nodeErrorList.begin(),Node.at(Gate.at(a).gateInput2).nodeErrorList.end());
-
-			sort(Node.at(Gate.at(a).gateOutput).nodeErrorList.begin(), Node.at(Gate.at(a).gateOutput).nodeErrorList.end());
-			Node.at(Gate.at(a).gateOutput).nodeErrorList.erase(unique(Node.at(Gate.at(a).gateOutput).nodeErrorList.begin(), Node.at(Gate.at(a).gateOutput).nodeErrorList.end()), Node.at(Gate.at(a).gateOutput).nodeErrorList.end());
+			string vector = "";
 
-			if (Node.at(Gate.at(a).gateOutput).SAvalue0 > 0)
-				if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue0)
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue0);
+			for (int j = 0; j < inputs; j++)
+				vector += ((rand() % 2) + 48);
 
-			if (Node.at(Gate.at(a).gateOutput).SAvalue1 > 0)
-				if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue1)
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue1);
+			hashLine(vector, vectorHash);
 		}
 
-		else if (Node.at(Gate.at(a).gateInput1).nodeValue == c && Node.at(Gate.at(a).gateInput2).nodeValue != c)
-		{
-			Node.at(Gate.at(a).gateOutput).nodeErrorList.reserve(Node.at(Gate.at(a).gateOutput).nodeErrorList.size() + Node.at(Gate.at(a).gateInput1).nodeErrorList.size() + 1);
-			Node.at(Gate.at(a).gateOutput).nodeErrorList.insert(Node.at(Gate.at(a).gateOutput).nodeErrorList.end(),Node.at(Gate.at(a).gateInput1).nodeErrorList.begin(),Node.at(Gate.at(a).gateInput1).nodeErrorList.end());
+		if (vectorHash != vectors)
+			return 2;
 
-			for (int i = 0; i < Node.at(Gate.at(a).gateInput2).nodeErrorList.size(); i++)
-				Node.at(Gate.at(a).gateOutput).nodeErrorList.erase(std::remove(Node.at(Gate.at(a).gateOutput).nodeErrorList.begin(), Node.at(Gate.at(a).gateOutput).nodeErrorList.end(), Node.at(Gate.at(a).gateInput2).nodeErrorList.at(i)), Node.at(Gate.at(a).gateOutput).nodeErrorList.end());
+		cout << endl << "Resuming after " << inputVectorCount << " input vectors";
 
-			if (Node.at(Gate.at(a).gateOutput).SAvalue0 > 0)
-				if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue0)
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue0);
+		return 1;
+	}
 
-			if (Node.at(Gate.at(a).gateOutput).SAvalue1 > 0)
-				if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue1)
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue1);
-		}
+	// Re-simulates the saved input vectors after gate edits for case 3
+	int createOutputFile_ECO()
+	{
+		int flag			= 1;
+		int baseFaultCount	= faultCount;
 
-		else if (Node.at(Gate.at(a).gateInput1).nodeValue != c && Node.at(Gate.at(a).gateInput2).nodeValue == c)
-		{
-			Node.at(Gate.at(a).gateOutput).nodeErrorList.reserve(Node.at(Gate.at(a).gateOutput).nodeErrorList.size() + Node.at(Gate.at(a).gateInput2).nodeErrorList.size() + 1);
-			Node.at(Gate.at(a).gateOutput).nodeErrorList.insert(Node.at(Gate.at(a).gateOutput).nodeErrorList.end(),Node.at(Gate.at(a).gateInput2).nodeErrorList.begin(),Node.at(Gate.at(a).gateInput2).nodeErrorList.end());
+		string fileName = "";
 
-			for (int i = 0; i < Node.at(Gate.at(a).gateInput1).nodeErrorList.size(); i++)
-				Node.at(Gate.at(a).gateOutput).nodeErrorList.erase(std::remove(Node.at(Gate.at(a).gateOutput).nodeErrorList.begin(), Node.at(Gate.at(a).gateOutput).nodeErrorList.end(), Node.at(Gate.at(a).gateInput1).nodeErrorList.at(i)), Node.at(Gate.at(a).gateOutput).nodeErrorList.end());
+		vector <int> seeds;													// Output nodes of the edited gates
+		vector <int> affectedGates;											// Gates in the fanout cones of the edits, levelized
+		vector <int> boundaryNodes;											// Nodes feeding the affected gates from outside the cones
+		vector <int> isAffected;											// Flag for the outputs of the affected gates
+		vector <int> errorLists, errorListStart;							// Buffers for rebuilding the fault lists of a snapshot
+		vector <int> affectedPOs, otherPOs;									// POs inside and outside the fanout cones
+		vector <int> baseFaults, ecoFaults;									// Flags for the faults detected before and after the edits
+		int			 baseDetected = 0, ecoDetected = 0;
+		vector <string> inputVectors;										// Input vectors to be re-simulated
 
-			if (Node.at(Gate.at(a).gateOutput).SAvalue0 > 0)
-				if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue0)
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue0);
+		outputFile.open("Outputs.txt");                         // Creating the output file
 
-			if (Node.at(Gate.at(a).gateOutput).SAvalue1 > 0)
-				if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue1)
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue1);
-		}
+		cout << endl << "Enter the file with the input vectors (without .txt): ";
+		cin  >> fileName;
+
+		flag = readVectors(fileName + ".txt", inputVectors);
+		if (flag != 1)
+			return flag;
 
+		// Simulating the base circuit unless its results for the same input vectors were saved earlier
+		if (loadSimulation(circuitName + ".sim") == 1 && savedVectorsMatch(inputVectors))
+			cout << endl << "Using the saved results of " << Snapshot.size() << " input vectors";
 		else
 		{
-			Node.at(Gate.at(a).gateOutput).nodeErrorList.reserve(Node.at(Gate.at(a).gateOutput).nodeErrorList.size() + Node.at(Gate.at(a).gateInput2).nodeErrorList.size() + 1);
+			simulateVectors(inputVectors);
+			saveSimulation(circuitName + ".sim");
+		}
 
-			for (int i = 0; i < Node.at(Gate.at(a).gateInput2).nodeErrorList.size(); i++)
-				for (int j = 0; j < Node.at(Gate.at(a).gateInput1).nodeErrorList.size(); j++)
-					if (Node.at(Gate.at(a).gateInput2).nodeErrorList.at(i) == Node.at(Gate.at(a).gateInput1).nodeErrorList.at(j))
-						Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateInput1).nodeErrorList.at(j));
+		cout << endl << "Enter the file with the gate edits (without .txt): ";
+		cin  >> fileName;
 
-			if (Node.at(Gate.at(a).gateOutput).SAvalue0 > 0)
-				if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue0)
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue0);
+		flag = applyEdits(fileName + ".txt", seeds);
+		if (flag != 1)
+			return flag;
 
-			if (Node.at(Gate.at(a).gateOutput).SAvalue1 > 0)
-				if (Gate.at(a).gateOutput * 10 + Node.at(Gate.at(a).gateOutput).nodeValue != Node.at(Gate.at(a).gateOutput).SAvalue1)
-					Node.at(Gate.at(a).gateOutput).nodeErrorList.push_back(Node.at(Gate.at(a).gateOutput).SAvalue1);
-		}
-	}
+		flag = findAffectedGates(seeds, affectedGates, boundaryNodes);
+		if (flag != 1)
+			return flag;
 
-private:
+		isAffected.assign(Node.size(), 0);
+		for (int i = 0; i < affectedGates.size(); i++)
+			isAffected.at(Gate.at(affectedGates.at(i)).gateOutput) = 1;
 
-}DFM_Func;
+		for (int i = 0; i < PONodes.size(); i++)
+			if (isAffected.at(PONodes.at(i)))
+				affectedPOs.push_back(PONodes.at(i));
+			else
+				otherPOs.push_back(PONodes.at(i));
 
-DeductiveFM::DeductiveFM()
+		baseFaults.assign(Node.size() * 10, 0);
+		ecoFaults.assign(Node.size() * 10, 0);
+
+		for (int v = 0; v < Snapshot.size(); v++)
+		{
+			vector <int> before, after, added, removed;
+
+			restoreSnapshot(v, boundaryNodes, affectedGates);
+
+			// Evaluating only the gates in the fanout cones, in level order
+			for (int i = 0; i < affectedGates.size(); i++)
+			{
+				checkOutput(affectedGates.at(i));
+				if (gateFlag.at(affectedGates.at(i)) != 1)
+					return 5;
+			}
+
+			// Only the fault lists of the POs in the fanout cones can change
+			markDetected(Snapshot.at(v), baseFaults, baseDetected);
+			detectedFaults(Snapshot.at(v), affectedPOs, before);
+
+			updateSnapshot(v, isAffected, errorLists, errorListStart);
+
+			markDetected(Snapshot.at(v), ecoFaults, ecoDetected);
+			detectedFaults(Snapshot.at(v), affectedPOs, after);
+
+			// A fault that changed at these POs is still detected if it reaches one of the other POs
+			set_difference(after.begin(), after.end(), before.begin(), before.end(), back_inserter(added));
+			set_difference(before.begin(), before.end(), after.begin(), after.end(), back_inserter(removed));
+
+			added.erase(remove_if(added.begin(), added.end(), [&](int fault) { return detectedAt(Snapshot.at(v), otherPOs, fault); }), added.end());
+			removed.erase(remove_if(removed.begin(), removed.end(), [&](int fault) { return detectedAt(Snapshot.at(v), otherPOs, fault); }), removed.end());
+
+			if (added.size() || removed.size())
+			{
+				cout << endl << "Input vector " << (v + 1) << " (" << Snapshot.at(v).inputVector << "):";
+				outputFile << endl << "Input vector " << (v + 1) << " (" << Snapshot.at(v).inputVector << "):";
+
+				cout << " newly detected ";
+				outputFile << " newly detected ";
+				for (int i = 0; i < added.size(); i++)
+				{
+					cout << added.at(i)/10 << " s-a " << added.at(i)%10 << " ";
+					outputFile << added.at(i)/10 << " s-a " << added.at(i)%10 << " ";
+				}
+
+				cout << "; no longer detected ";
+				outputFile << "; no longer detected ";
+				for (int i = 0; i < removed.size(); i++)
+				{
+					cout << removed.at(i)/10 << " s-a " << removed.at(i)%10 << " ";
+					outputFile << removed.at(i)/10 << " s-a " << removed.at(i)%10 << " ";
+				}
+			}
+
+		}
+
+		cout << endl << endl << "Gates re-simulated per input vector : " << affectedGates.size() << " out of " << Gate.size();
+		outputFile << endl << endl << "Gates re-simulated per input vector : " << affectedGates.size() << " out of " << Gate.size();
+
+		cout << endl << "Before the edits " << baseDetected << " out of " << baseFaultCount << " faults were detected, fault coverage : " << (baseDetected * 100) / baseFaultCount;
+		outputFile << endl << "Before the edits " << baseDetected << " out of " << baseFaultCount << " faults were detected, fault coverage : " << (baseDetected * 100) / baseFaultCount;
+
+		cout << endl << "After the edits " << ecoDetected << " out of " << faultCount << " faults are detected, fault coverage : " << (ecoDetected * 100) / faultCount;
+		outputFile << endl << "After the edits " << ecoDetected << " out of " << faultCount << " faults are detected, fault coverage : " << (ecoDetected * 100) / faultCount;
+
+		// Saving the edited circuit and its results as the base for the next edits
+		writeCircuitFile(circuitName + "_eco.txt");
+		saveSimulation(circuitName + "_eco.sim");
+
+		cout << endl << "The edited circuit is saved as " << circuitName << "_eco";
+		outputFile << endl << "The edited circuit is saved as " << circuitName << "_eco";
+
+		outputFile.close();
+		return 1;
+	}
+
+	// Reads the input vectors for case 3
+	int readVectors(string fileName, vector <string> &inputVectors)
+	{
+		string line = "";
+
+		ifstream vectorFile(fileName);
+
+		if (!vectorFile.is_open())
+			return 0;
+
+		inputVectors.clear();
+
+		while (vectorFile >> line)
+		{
+			if (line.length() != PINodes.size())
+				return 4;
+
+			inputVectors.push_back(line);
+		}
+
+		vectorFile.close();
+
+		if (inputVectors.size() == 0)
+			return 6;
+
+		return 1;
+	}
+
+	// Checks if the loaded results are for the given input vectors
+	int savedVectorsMatch(vector <string> &inputVectors)
+	{
+		if (Snapshot.size() != inputVectors.size())
+			return 0;
+
+		for (int v = 0; v < Snapshot.size(); v++)
+			if (Snapshot.at(v).inputVector != inputVectors.at(v))
+				return 0;
+
+		return 1;
+	}
+
+	// Simulates the input vectors and keeps a snapshot of each for case 3
+	void simulateVectors(vector <string> &inputVectors)
+	{
+		Snapshot.clear();
+
+		for (int v = 0; v < inputVectors.size(); v++)
+		{
+			for (int i = 0; i < Node.size(); i++)
+			{
+				Node.at(i).nodeFlag = 0;
+				Node.at(i).nodeErrorList.clear();
+			}
+
+			for (int i = 0; i < Gate.size(); i++)
+				gateFlag.at(i) = 0;
+
+			inputValues = inputVectors.at(v);
+			applyInputVector();
+			calculateOutputs();
+
+			S.inputVector = inputValues;
+			takeSnapshot(S);
+			Snapshot.push_back(S);
+		}
+	}
+
+	// Copies the node values and fault lists into a snapshot
+	void takeSnapshot(Snapshots &snapshot)
+	{
+		snapshot.nodeValues.resize(Node.size());
+		snapshot.errorListStart.resize(Node.size() + 1);
+		snapshot.nodeErrorLists.clear();
+
+		for (int i = 0; i < Node.size(); i++)
+		{
+			snapshot.nodeValues[i]			= (char) Node.at(i).nodeValue;
+			snapshot.errorListStart.at(i)	= snapshot.nodeErrorLists.size();
+			snapshot.nodeErrorLists.insert(snapshot.nodeErrorLists.end(), Node.at(i).nodeErrorList.begin(), Node.at(i).nodeErrorList.end());
+		}
+
+		snapshot.errorListStart.at(Node.size()) = snapshot.nodeErrorLists.size();
+	}
+
+	// Restores the nodes feeding the affected gates from a snapshot and clears the outputs of the affected gates
+	void restoreSnapshot(int v, vector <int> &boundaryNodes, vector <int> &affectedGates)
+	{
+		Snapshots &snapshot = Snapshot.at(v);
+
+		for (int i = 0; i < boundaryNodes.size(); i++)
+		{
+			int node = boundaryNodes.at(i);
+
+			Node.at(node).nodeValue = snapshot.nodeValues[node];
+			Node.at(node).nodeErrorList.assign(snapshot.nodeErrorLists.begin() + snapshot.errorListStart.at(node), snapshot.nodeErrorLists.begin() + snapshot.errorListStart.at(node + 1));
+			Node.at(node).nodeFlag	= 1;
+		}
+
+		for (int i = 0; i < affectedGates.size(); i++)
+		{
+			gateFlag.at(affectedGates.at(i)) = 0;
+			Node.at(Gate.at(affectedGates.at(i)).gateOutput).nodeFlag = 0;
+			Node.at(Gate.at(affectedGates.at(i)).gateOutput).nodeErrorList.clear();
+		}
+	}
+
+	// Writes the re-simulated outputs of the affected gates back into a snapshot, keeping the other nodes
+	// The fault lists are rebuilt in the given buffers, which are swapped with the snapshot so that they are reused
+	void updateSnapshot(int v, vector <int> &isAffected, vector <int> &errorLists, vector <int> &errorListStart)
+	{
+		Snapshots	&snapshot = Snapshot.at(v);
+		int			oldNodes  = snapshot.nodeValues.size();					// Fewer than now if the edits added nodes
+		int			oldEnd	  = snapshot.errorListStart.at(oldNodes);
+		int			copied	  = 0;											// The old fault lists are copied up to here
+
+		snapshot.nodeValues.resize(Node.size(), 0);
+		errorLists.clear();
+		errorListStart.resize(Node.size() + 1);
+
+		for (int i = 0; i < Node.size(); i++)
+		{
+			int oldStart = (i < oldNodes) ? snapshot.errorListStart.at(i) : oldEnd;
+
+			if (isAffected.at(i))
+			{
+				// Copying the unchanged fault lists before this node in one go
+				errorLists.insert(errorLists.end(), snapshot.nodeErrorLists.begin() + copied, snapshot.nodeErrorLists.begin() + oldStart);
+
+				errorListStart.at(i) = errorLists.size();
+				errorLists.insert(errorLists.end(), Node.at(i).nodeErrorList.begin(), Node.at(i).nodeErrorList.end());
+
+				snapshot.nodeValues[i] = (char) Node.at(i).nodeValue;
+				copied = (i < oldNodes) ? snapshot.errorListStart.at(i + 1) : oldEnd;
+			}
+			else
+				errorListStart.at(i) = errorLists.size() + oldStart - copied;
+		}
+
+		errorLists.insert(errorLists.end(), snapshot.nodeErrorLists.begin() + copied, snapshot.nodeErrorLists.begin() + oldEnd);
+		errorListStart.at(Node.size()) = errorLists.size();
+
+		snapshot.nodeErrorLists.swap(errorLists);
+		snapshot.errorListStart.swap(errorListStart);
+	}
+
+	// Sorted list of the faults reaching the given POs in a snapshot
+	void detectedFaults(Snapshots &snapshot, vector <int> &POs, vector <int> &faults)
+	{
+		faults.clear();
+
+		for (int i = 0; i < POs.size(); i++)
+			faults.insert(faults.end(), snapshot.nodeErrorLists.begin() + snapshot.errorListStart.at(POs.at(i)), snapshot.nodeErrorLists.begin() + snapshot.errorListStart.at(POs.at(i) + 1));
+
+		sort(faults.begin(), faults.end());
+		faults.erase(unique(faults.begin(), faults.end()), faults.end());
+	}
+
+	// Checks if a fault reaches any of the given POs in a snapshot, the fault lists being sorted
+	int detectedAt(Snapshots &snapshot, vector <int> &POs, int fault)
+	{
+		for (int i = 0; i < POs.size(); i++)
+			if (binary_search(snapshot.nodeErrorLists.begin() + snapshot.errorListStart.at(POs.at(i)), snapshot.nodeErrorLists.begin() + snapshot.errorListStart.at(POs.at(i) + 1), fault))
+				return 1;
+		return 0;
+	}
+
+	// Flags the faults reaching the POs in a snapshot, counting the ones not flagged before
+	void markDetected(Snapshots &snapshot, vector <int> &detected, int &count)
+	{
+		for (int i = 0; i < PONodes.size(); i++)
+			for (int j = snapshot.errorListStart.at(PONodes.at(i)); j < snapshot.errorListStart.at(PONodes.at(i) + 1); j++)
+				if (detected.at(snapshot.nodeErrorLists.at(j)) == 0)
+				{
+					detected.at(snapshot.nodeErrorLists.at(j)) = 1;
+					count++;
+				}
+	}
+
+	// Applies the gate edits and collects the output nodes of the edited gates
+	int applyEdits(string fileName, vector <int> &seeds)
+	{
+		string line = "";
+
+		ifstream editFile(fileName);
+
+		if (!editFile.is_open())
+			return 2;
+
+		while (getline(editFile, line))
+		{
+			string	edit = "", type = "";
+			int		out	 = 0, a = -1;
+			vector <int> nodes;
+
+			istringstream iss(line);
+			iss >> edit;
+
+			if (edit == "")
+				continue;
+
+			// ADD <type> <inputs> <output>
+			if (edit == "ADD")
+			{
+				iss >> type;
+				while (iss >> out)
+					nodes.push_back(out);
+
+				if (nodes.size() < 2 || !validInputs(type, nodes.size() - 1) || isDriven(nodes.back()))
+					return 3;
+
+				G.gateType	 = type;
+				G.gateOutput = nodes.back();
+				G.gateInputs.assign(nodes.begin(), nodes.end() - 1);
+
+				Gate.push_back(G);
+
+				// New gate outputs are new fault locations
+				if (find(GONodes.begin(), GONodes.end(), G.gateOutput) == GONodes.end())
+				{
+					GONodes.push_back(G.gateOutput);
+
+					if (faultChoice == 3 || faultChoice == 5)
+						faultCount += 2;
+				}
+
+				seeds.push_back(G.gateOutput);
+			}
+			// REMOVE <output>
+			else if (edit == "REMOVE")
+			{
+				iss >> out;
+
+				a = findGate(out);
+				if (a == -1)
+					return 3;
+
+				Gate.erase(Gate.begin() + a);
+				GONodes.erase(find(GONodes.begin(), GONodes.end(), out));
+
+				if (faultChoice == 3 || faultChoice == 5)
+					faultCount -= 2;
+
+				seeds.push_back(out);
+			}
+			// RETYPE <output> <type>
+			else if (edit == "RETYPE")
+			{
+				iss >> out >> type;
+
+				a = findGate(out);
+				if (a == -1 || !validInputs(type, Gate.at(a).gateInputs.size()))
+					return 3;
+
+				Gate.at(a).gateType = type;
+				seeds.push_back(out);
+			}
+			// REWIRE <output> <inputs>
+			else if (edit == "REWIRE")
+			{
+				iss >> out;
+				while (iss >> a)
+					nodes.push_back(a);
+
+				a = findGate(out);
+				if (a == -1 || !validInputs(Gate.at(a).gateType, nodes.size()))
+					return 3;
+
+				Gate.at(a).gateInputs = nodes;
+
+				seeds.push_back(out);
+			}
+			else
+				return 3;
+		}
+
+		editFile.close();
+
+		// Numbering the gates again and rebuilding the fanouts
+		for (int i = 0; i < Node.size(); i++)
+			listofGates.at(i).clear();
+
+		for (int i = 0; i < Gate.size(); i++)
+		{
+			Gate.at(i).gateNumber = i;
+
+			addNode(Gate.at(i).gateOutput);
+
+			for (int j = 0; j < Gate.at(i).gateInputs.size(); j++)
+			{
+				addNode(Gate.at(i).gateInputs.at(j));
+
+				listofGates.at(Gate.at(i).gateInputs.at(j)).push_back(i);
+			}
+		}
+
+		gateFlag.assign(Gate.size(), 0);
+
+		// Indexing the gate driving each node once, for the checks below and findAffectedGates()
+		driverGate.assign(Node.size(), -1);
+		for (int i = 0; i < Gate.size(); i++)
+			driverGate.at(Gate.at(i).gateOutput) = i;
+
+		vector <int> driven(Node.size(), 0);
+		for (int i = 0; i < PINodes.size(); i++)
+			driven.at(PINodes.at(i)) = 1;
+		for (int i = 0; i < Gate.size(); i++)
+			driven.at(Gate.at(i).gateOutput) = 1;
+
+		// Removed gate outputs are no longer fault locations
+		for (int i = 0; i < seeds.size(); i++)
+			if (driverGate.at(seeds.at(i)) == -1)
+			{
+				Node.at(seeds.at(i)).SAvalue0 = 0;
+				Node.at(seeds.at(i)).SAvalue1 = 0;
+			}
+			else if (faultChoice == 3 || faultChoice == 5)
+			{
+				Node.at(seeds.at(i)).SAvalue0 = seeds.at(i) * 10 + 0;
+				Node.at(seeds.at(i)).SAvalue1 = seeds.at(i) * 10 + 1;
+			}
+
+		// Every gate input and PO must still be driven
+		for (int i = 0; i < Gate.size(); i++)
+			for (int j = 0; j < Gate.at(i).gateInputs.size(); j++)
+				if (driven.at(Gate.at(i).gateInputs.at(j)) == 0)
+					return 5;
+
+		for (int i = 0; i < PONodes.size(); i++)
+			if (PONodes.at(i) >= Node.size() || driven.at(PONodes.at(i)) == 0)
+				return 5;
+
+		return 1;
+	}
+
+	// Checks if a gate type can have the given number of inputs
+	int validInputs(string type, int inputs)
+	{
+		if (type == "INV" || type == "BUF")
+			return (inputs == 1);
+		if (type == "AND" || type == "NAND" || type == "OR" || type == "NOR" || type == "XOR" || type == "XNOR")
+			return (inputs >= 2);
+		return 0;
+	}
+
+	// Index of the gate driving a node, -1 if there is none
+	int findGate(int node)
+	{
+		for (int i = 0; i < Gate.size(); i++)
+			if (Gate.at(i).gateOutput == node)
+				return i;
+		return -1;
+	}
+
+	// Checks if a node is a PI or a gate output
+	int isDriven(int node)
+	{
+		return (find(PINodes.begin(), PINodes.end(), node) != PINodes.end() || findGate(node) != -1);
+	}
+
+	// Collects the gates in the fanout cones of the edited nodes in level order, and the nodes feeding them from outside
+	int findAffectedGates(vector <int> &seeds, vector <int> &affectedGates, vector <int> &boundaryNodes)
+	{
+		vector <int> visited(Node.size(), 0);
+		vector <int> queue;
+		vector <int> order;
+
+		for (int i = 0; i < seeds.size(); i++)
+			if (driverGate.at(seeds.at(i)) != -1 && visited.at(seeds.at(i)) == 0)
+			{
+				visited.at(seeds.at(i)) = 1;
+				queue.push_back(seeds.at(i));
+			}
+
+		for (int i = 0; i < queue.size(); i++)
+			for (int j = 0; j < listofGates.at(queue.at(i)).size(); j++)
+			{
+				int out = Gate.at(listofGates.at(queue.at(i)).at(j)).gateOutput;
+
+				if (visited.at(out) == 0)
+				{
+					visited.at(out) = 1;
+					queue.push_back(out);
+				}
+			}
+
+		levelizeGates(order);
+
+		affectedGates.clear();
+		for (int i = 0; i < order.size(); i++)
+			if (visited.at(Gate.at(order.at(i)).gateOutput) == 1)
+				affectedGates.push_back(order.at(i));
+
+		// A gate in a loop is never levelized
+		if (affectedGates.size() != queue.size())
+			return 5;
+
+		boundaryNodes.clear();
+		for (int i = 0; i < affectedGates.size(); i++)
+			for (int j = 0; j < Gate.at(affectedGates.at(i)).gateInputs.size(); j++)
+			{
+				int in = Gate.at(affectedGates.at(i)).gateInputs.at(j);
+
+				if (visited.at(in) == 0)
+				{
+					visited.at(in) = 2;
+					boundaryNodes.push_back(in);
+				}
+			}
+
+		return 1;
+	}
+
+	// Writes the circuit in the input file format
+	void writeCircuitFile(string fileName)
+	{
+		ofstream circuitFile(fileName);
+
+		netlistHash = 2166136261u;
+
+		for (int i = 0; i < Gate.size(); i++)
+		{
+			ostringstream oss;
+
+			oss << Gate.at(i).gateType;
+			for (int j = 0; j < Gate.at(i).gateInputs.size(); j++)
+				oss << " " << Gate.at(i).gateInputs.at(j);
+			oss << " " << Gate.at(i).gateOutput;
+
+			circuitFile << oss.str() << endl;
+			hashLine(oss.str());
+		}
+
+		for (int i = 0; i < FlipFlop.size(); i++)
+		{
+			ostringstream oss;
+
+			oss << "DFF " << FlipFlop.at(i).gateInputs.at(0) << " " << FlipFlop.at(i).gateOutput;
+
+			circuitFile << oss.str() << endl;
+			hashLine(oss.str());
+		}
+
+		ostringstream inputs, outputs;
+
+		// Leaving out the pseudo PIs and POs of the flip-flops
+		inputs << "INPUT ";
+		for (int i = 0; i < PINodes.size() - FlipFlop.size(); i++)
+			inputs << " " << PINodes.at(i);
+		inputs << " -1";
+
+		outputs << "OUTPUT ";
+		for (int i = 0; i < PONodes.size() - FlipFlop.size(); i++)
+			outputs << " " << PONodes.at(i);
+		outputs << " -1";
+
+		circuitFile << inputs.str() << endl << outputs.str() << endl;
+		hashLine(inputs.str());
+		hashLine(outputs.str());
+
+		circuitFile.close();
+	}
+
+	// Saves the per-vector results of case 3, in binary so that loading them is cheaper than simulating again
+	void saveSimulation(string fileName)
+	{
+		int header[5] = { (int) netlistHash, faultChoice, faultCount, (int) Node.size(), (int) Snapshot.size() };
+
+		ofstream simFile(fileName, ios::binary);
+
+		if (!simFile.is_open())
+			return;
+
+		simFile << "DFS_SIMULATION" << endl;
+		simFile.write((char *) header, sizeof(header));
+
+		// For every vector: the input vector, the node values, the starts of the fault lists and then the fault lists
+		for (int v = 0; v < Snapshot.size(); v++)
+		{
+			simFile.write(Snapshot.at(v).inputVector.data(), PINodes.size());
+			simFile.write(Snapshot.at(v).nodeValues.data(), Node.size());
+			simFile.write((char *) Snapshot.at(v).errorListStart.data(), (Node.size() + 1) * sizeof(int));
+			simFile.write((char *) Snapshot.at(v).nodeErrorLists.data(), Snapshot.at(v).nodeErrorLists.size() * sizeof(int));
+		}
+
+		simFile.close();
+	}
+
+	// Loads the per-vector results of case 3 if they match the circuit
+	int loadSimulation(string fileName)
+	{
+		string line		 = "";
+		int	   nodes	 = Node.size();
+		int	   header[5] = { 0, 0, 0, 0, 0 };
+
+		ifstream simFile(fileName, ios::binary);
+
+		if (!simFile.is_open())
+			return 0;
+
+		getline(simFile, line);
+		simFile.read((char *) header, sizeof(header));
+
+		// Rejecting saved results of another circuit, or damaged ones, instead of trusting their counts
+		if (!simFile || line != "DFS_SIMULATION" || (unsigned int) header[0] != netlistHash || header[1] != faultChoice || header[2] != faultCount || header[3] != nodes || header[4] < 0)
+			return 2;
+
+		Snapshot.clear();
+
+		for (int v = 0; v < header[4] && simFile; v++)
+		{
+			Snapshot.push_back(S);
+
+			Snapshots &snapshot = Snapshot.back();
+
+			snapshot.inputVector.resize(PINodes.size());
+			snapshot.nodeValues.resize(nodes);
+			snapshot.errorListStart.resize(nodes + 1);
+
+			simFile.read(&snapshot.inputVector[0], PINodes.size());
+			simFile.read(&snapshot.nodeValues[0], nodes);
+			simFile.read((char *) snapshot.errorListStart.data(), (nodes + 1) * sizeof(int));
+
+			// Every fault list must have between 0 and faultCount faults, each of them on a node of the circuit
+			int valid = (snapshot.errorListStart[0] == 0);
+
+			for (int i = 0; i < nodes; i++)
+				valid &= (snapshot.errorListStart[i + 1] >= snapshot.errorListStart[i] && snapshot.errorListStart[i + 1] - snapshot.errorListStart[i] <= faultCount);
+
+			if (!valid)
+				simFile.setstate(ios::failbit);
+
+			if (!simFile)
+				break;
+
+			snapshot.nodeErrorLists.resize(snapshot.errorListStart[nodes]);
+			simFile.read((char *) snapshot.nodeErrorLists.data(), snapshot.nodeErrorLists.size() * sizeof(int));
+
+			for (int i = 0; i < snapshot.nodeErrorLists.size(); i++)
+				valid &= (snapshot.nodeErrorLists[i] >= 0 && snapshot.nodeErrorLists[i] < nodes * 10);
+
+			if (!valid)
+				simFile.setstate(ios::failbit);
+		}
+
+		if (!simFile)
+		{
+			Snapshot.clear();
+			return 2;
+		}
+
+		return 1;
+	}
+
+	// Simulates a sequence of input vectors over clock cycles for case 4
+	int createOutputFile_SEQ()
+	{
+		int cycle = 0;
+
+		string fileName = "";
+		string state	= "";													// Values of the flip-flops
+
+		vector <int> order;														// Levelized gates, reused in every cycle
+		vector < vector <int> > stateErrorLists(FlipFlop.size());				// Faults that have changed the state of each flip-flop
+
+		outputFile.open("Outputs.txt");                         // Creating the output file
+
+		levelizeGates(order);
+		if (order.size() != Gate.size())
+			return 5;
+
+		if (FlipFlop.size())
+		{
+			cout << endl << "Initial state of the flip-flops (" << FlipFlop.size() << " flip-flops): ";
+			cin  >> state;
+
+			if (state.length() != FlipFlop.size())
+				return 4;
+		}
+
+		cout << endl << "Enter the file with the input sequence, one input vector per clock cycle (without .txt): ";
+		cin  >> fileName;
+
+		ifstream sequenceFile(fileName + ".txt");
+
+		if (!sequenceFile.is_open())
+			return 0;
+
+		while (sequenceFile >> inputValues)
+		{
+			vector <int> detected;
+
+			if (inputValues.length() != PINodes.size())
+				return 4;
+
+			cycle++;
+
+			for (int i = 0; i < Node.size(); i++)
+			{
+				Node.at(i).nodeFlag = 0;
+				Node.at(i).nodeErrorList.clear();
+			}
+
+			applyInputVector();
+
+			// The flip-flop outputs carry the state and its faults from the last cycle
+			for (int i = 0; i < FlipFlop.size(); i++)
+			{
+				Node.at(FlipFlop.at(i).gateOutput).nodeValue	 = (int)(state[i] - 48);
+				Node.at(FlipFlop.at(i).gateOutput).nodeFlag		 = 1;
+				Node.at(FlipFlop.at(i).gateOutput).nodeErrorList = stateErrorLists.at(i);
+
+				addOutputFault(FlipFlop.at(i).gateOutput);
+			}
+
+			for (int i = 0; i < order.size(); i++)
+				evaluateGate(order.at(i));
+
+			for (int i = 0; i < PONodes.size(); i++)
+				detected.insert(detected.end(), Node.at(PONodes.at(i)).nodeErrorList.begin(), Node.at(PONodes.at(i)).nodeErrorList.end());
+
+			sort(detected.begin(), detected.end());
+			detected.erase(unique(detected.begin(), detected.end()), detected.end());
+
+			cout << endl << "Cycle " << cycle << " (" << inputValues << ", state " << state << "): " << detected.size() << " faults detected";
+			outputFile << endl << "Cycle " << cycle << " (" << inputValues << ", state " << state << "): " << detected.size() << " faults detected";
+
+			faultList.insert(faultList.end(), detected.begin(), detected.end());
+
+			// Clocking the flip-flops
+			for (int i = 0; i < FlipFlop.size(); i++)
+			{
+				state[i] = (char)(Node.at(FlipFlop.at(i).gateInputs.at(0)).nodeValue + 48);
+				stateErrorLists.at(i) = Node.at(FlipFlop.at(i).gateInputs.at(0)).nodeErrorList;
+			}
+		}
+
+		sequenceFile.close();
+
+		sort(faultList.begin(), faultList.end());
+		faultList.erase(unique(faultList.begin(), faultList.end()), faultList.end());
+
+		cout << endl << endl << "The total number of clock cycles applied are : " << cycle;
+		outputFile << endl << endl << "The total number of clock cycles applied are : " << cycle;
+
+		cout << endl << "The total number of faults detected are " << faultList.size() << " out of " << faultCount;
+		outputFile << endl << "The total number of faults detected are " << faultList.size() << " out of " << faultCount;
+
+		cout << endl << "The fault coverage is : " << (faultList.size() * 100) / faultCount;
+		outputFile << endl << "The fault coverage is : " << (faultList.size() * 100) / faultCount;
+
+		cout << endl << "The final fault list is : ";
+		outputFile << endl << "The final fault list is : ";
+
+		for (int i = 0; i < faultList.size(); i++)
+		{
+			cout << faultList.at(i)/10 << " s-a " << faultList.at(i)%10 << " ";
+			outputFile << faultList.at(i) << " ";
+		}
+
+		outputFile.close();
+		return 1;
+	}
+
+	// Simulates the pattern set of a batch job, touching only the state of this object
+	int runJob(Jobs &job)
+	{
+		string line = "";
+
+		vector <string> vectors;
+
+		if (SAFaultList(job.faultChoice) == 0)
+			return 2;
+
+		// Generating the random patterns, the same for every run of the job
+		if (job.patterns.compare(0, 7, "random:") == 0)
+		{
+			mt19937 generator(1);
+
+			for (int v = 0; v < atoi(job.patterns.c_str() + 7); v++)
+			{
+				line = "";
+				for (int i = 0; i < PINodes.size(); i++)
+					line += (char)((generator() % 2) + 48);
+				vectors.push_back(line);
+			}
+		}
+		else
+		{
+			ifstream vectorFile(job.patterns + ".txt");
+
+			if (!vectorFile.is_open())
+				return 3;
+
+			while (vectorFile >> line)
+				vectors.push_back(line);
+		}
+
+		for (int v = 0; v < vectors.size(); v++)
+		{
+			if (vectors.at(v).length() != PINodes.size())
+				return 4;
+
+			for (int i = 0; i < Node.size(); i++)
+			{
+				Node.at(i).nodeFlag = 0;
+				Node.at(i).nodeErrorList.clear();
+			}
+
+			for (int i = 0; i < Gate.size(); i++)
+				gateFlag.at(i) = 0;
+
+			inputValues = vectors.at(v);
+			applyInputVector();
+			calculateOutputs();
+		}
+
+		job.vectorCount	   = vectors.size();
+		job.faultsDetected = faultList.size();
+		job.faultCount	   = faultCount;
+
+		return 1;
+	}
+
+	// Displays the final outputs for Case 1
+	void displayOutputs()
+	{
+		evaluateCircuit(1);
+
+		for (int i = 0; i < PONodes.size(); i++)
+		{
+			if (Node.at(PONodes.at(i)).nodeErrorList.size())
+			{
+				cout << endl << "The faults propagated at the node " << PONodes.at(i) << " are: ";
+				outputFile << endl << "The faults propagated at the node " << PONodes.at(i) << " are: ";
+			}
+
+			for (int j = 0; j < Node.at(PONodes.at(i)).nodeErrorList.size(); j++)
+			{
+				cout << Node.at(PONodes.at(i)).nodeErrorList.at(j)/10 << " s-a " << Node.at(PONodes.at(i)).nodeErrorList.at(j)%10 << " , ";
+				outputFile << Node.at(PONodes.at(i)).nodeErrorList.at(j)/10 << " s-a " << Node.at(PONodes.at(i)).nodeErrorList.at(j)%10 << " , ";
+
+				faultList.push_back(Node.at(PONodes.at(i)).nodeErrorList.at(j));
+			}
+
+			if (Node.at(PONodes.at(i)).nodeErrorList.size())
+			{
+				cout << "\b\b ";
+				outputFile << "b\b ";
+			}
+		}
+	}
+
+	// Calculate outputs for Case 2
+	void calculateOutputs()
+	{
+		evaluateCircuit(0);
+	}
+
+	// Merges the faults at the POs into faultList, keeping it sorted and without repeats
+	void mergePOFaults()
+	{
+		int oldSize = faultList.size();
+
+		for (int i = 0; i < PONodes.size(); i++)
+			faultList.insert(faultList.end(), Node.at(PONodes.at(i)).nodeErrorList.begin(), Node.at(PONodes.at(i)).nodeErrorList.end());
+
+		sort(faultList.begin() + oldSize, faultList.end());
+		inplace_merge(faultList.begin(), faultList.begin() + oldSize, faultList.end());
+		faultList.erase(unique(faultList.begin(), faultList.end()), faultList.end());
+	}
+
+	// Evaluates the gates for the current input vector, one pass at a time if the faults are split
+	void evaluateCircuit(int keepPOLists)
+	{
+		if (faultPasses == 1)
+		{
+			while (checkOutputValue(PONodes) != 1)
+				for (int i = 0 ; i < Gate.size() ; i++)
+					if (gateFlag.at(i) != 1)
+						checkOutput(i);
+
+			if (keepPOLists == 0)
+				mergePOFaults();
+			return;
+		}
+
+		// Case 1 reports the faults of every PO, case 2 only needs them in faultList
+		vector < vector <int> > POErrorLists(keepPOLists ? PONodes.size() : 0);
+
+		for (int pass = 0; pass < faultPasses; pass++)
+		{
+			selectFaultPass(pass);
+
+			for (int i = 0; i < Node.size(); i++)
+			{
+				Node.at(i).nodeFlag = 0;
+				Node.at(i).nodeErrorList.clear();
+			}
+
+			for (int i = 0; i < Gate.size(); i++)
+				gateFlag.at(i) = 0;
+
+			applyInputVector();
+
+			while (checkOutputValue(PONodes) != 1)
+				for (int i = 0 ; i < Gate.size() ; i++)
+					if (gateFlag.at(i) != 1)
+						checkOutput(i);
+
+			if (keepPOLists == 0)
+			{
+				mergePOFaults();
+				continue;
+			}
+
+			for (int i = 0; i < PONodes.size(); i++)
+			{
+				vector <int> merged;
+
+				set_union(POErrorLists.at(i).begin(), POErrorLists.at(i).end(), Node.at(PONodes.at(i)).nodeErrorList.begin(), Node.at(PONodes.at(i)).nodeErrorList.end(), back_inserter(merged));
+				POErrorLists.at(i).swap(merged);
+			}
+		}
+
+		// Merging the passes at the POs
+		for (int i = 0; i < PONodes.size() && keepPOLists; i++)
+			Node.at(PONodes.at(i)).nodeErrorList.swap(POErrorLists.at(i));
+	}
+
+	// Checks if the POs have values assigned
+	int checkOutputValue(vector <int> outputNode)
+	{
+		int a = 0;
+
+		for (int i = 0; i < outputNode.size(); i++)
+		{
+			a = outputNode.at(i);
+			if (Node.at(a).nodeFlag != 1)
+				return 0;
+		}
+
+		return 1;
+	}
+
+	// Evaluates every gate
+	void checkOutput(int a)
+	{
+		if (gateFlag.at(a) == 1)
+			return;
+
+		for (int i = 0; i < Gate.at(a).gateInputs.size(); i++)
+			if (Node.at(Gate.at(a).gateInputs.at(i)).nodeFlag != 1)
+				return;
+
+		evaluateGate(a);
+		checkNode(Gate.at(a).gateOutput);
+	}
+
+	// Assigns the value and the fault list at the output of a gate whose inputs have values
+	void evaluateGate(int a)
+	{
+		int value = 0;
+
+		gateFlag.at(a) = 1;
+
+		if (Gate.at(a).gateType == "INV" || Gate.at(a).gateType == "BUF")
+		{
+			value = Node.at(Gate.at(a).gateInputs.at(0)).nodeValue;
+
+			Node.at(Gate.at(a).gateOutput).nodeValue = (Gate.at(a).gateType == "INV") ? !value : value;
+			Node.at(Gate.at(a).gateOutput).nodeFlag = 1;
+
+			errorList(a, -1);										// No controlling value
+		}
+
+		else if (Gate.at(a).gateType == "AND" || Gate.at(a).gateType == "NAND")
+		{
+			value = 1;
+			for (int i = 0; i < Gate.at(a).gateInputs.size(); i++)
+				value &= Node.at(Gate.at(a).gateInputs.at(i)).nodeValue;
+
+			Node.at(Gate.at(a).gateOutput).nodeValue = (Gate.at(a).gateType == "NAND") ? !value : value;
+			Node.at(Gate.at(a).gateOutput).nodeFlag = 1;
+
+			errorList(a, 0);										// Output node of gate, controlling variable of Gate
+		}
+
+		else if (Gate.at(a).gateType == "OR" || Gate.at(a).gateType == "NOR")
+		{
+			value = 0;
+			for (int i = 0; i < Gate.at(a).gateInputs.size(); i++)
+				value |= Node.at(Gate.at(a).gateInputs.at(i)).nodeValue;
+
+			Node.at(Gate.at(a).gateOutput).nodeValue = (Gate.at(a).gateType == "NOR") ? !value : value;
+			Node.at(Gate.at(a).gateOutput).nodeFlag = 1;
+
+			errorList(a, 1);										// Output node of gate, controlling variable of Gate
+		}
+
+		else if (Gate.at(a).gateType == "XOR" || Gate.at(a).gateType == "XNOR")
+		{
+			value = 0;
+			for (int i = 0; i < Gate.at(a).gateInputs.size(); i++)
+				value ^= Node.at(Gate.at(a).gateInputs.at(i)).nodeValue;
+
+			Node.at(Gate.at(a).gateOutput).nodeValue = (Gate.at(a).gateType == "XNOR") ? !value : value;
+			Node.at(Gate.at(a).gateOutput).nodeFlag = 1;
+
+			parityErrorList(a);
+		}
+	}
+
+	// Propagates the values at every node
+	void checkNode(int a)
+	{
+		for (int i = 0 ; i < listofGates.at(a).size() ; i++)
+			if (gateFlag.at(listofGates.at(a).at(i)) != 1)
+				checkOutput(listofGates.at(a).at(i));
+	}
+
+	// Propagates faults from gate inputs to outputs based on the controlling values
+	// The fault lists are kept sorted so that they can be combined with the set operations
+	void errorList(int a, int c)
+	{
+		vector <int> controlling, nonControlling, temp;
+		int			 controlled = 0;											// Whether any input is at the controlling value
+
+		for (int i = 0; i < Gate.at(a).gateInputs.size(); i++)
+		{
+			vector <int> &inputList = Node.at(Gate.at(a).gateInputs.at(i)).nodeErrorList;
+
+			// Faults at the controlling inputs must flip all of them to reach the output
+			if (Node.at(Gate.at(a).gateInputs.at(i)).nodeValue == c)
+			{
+				if (controlled == 0)
+					controlling = inputList;
+				else
+				{
+					temp.clear();
+					set_intersection(controlling.begin(), controlling.end(), inputList.begin(), inputList.end(), back_inserter(temp));
+					controlling.swap(temp);
+				}
+
+				controlled = 1;
+			}
+			// Faults at the non-controlling inputs reach the output unless an input stays controlling
+			else
+			{
+				temp.clear();
+				set_union(nonControlling.begin(), nonControlling.end(), inputList.begin(), inputList.end(), back_inserter(temp));
+				nonControlling.swap(temp);
+			}
+		}
+
+		vector <int> &outputList = Node.at(Gate.at(a).gateOutput).nodeErrorList;
+
+		outputList.clear();
+
+		if (controlled == 0)
+			outputList.swap(nonControlling);
+		else
+			set_difference(controlling.begin(), controlling.end(), nonControlling.begin(), nonControlling.end(), back_inserter(outputList));
+
+		addOutputFault(Gate.at(a).gateOutput);
+	}
+
+	// Propagates faults through XOR and XNOR gates, where a fault reaches the output if it flips an odd number of inputs
+	void parityErrorList(int a)
+	{
+		vector <int> temp;
+		vector <int> &outputList = Node.at(Gate.at(a).gateOutput).nodeErrorList;
+
+		outputList.clear();
+
+		for (int i = 0; i < Gate.at(a).gateInputs.size(); i++)
+		{
+			vector <int> &inputList = Node.at(Gate.at(a).gateInputs.at(i)).nodeErrorList;
+
+			temp.clear();
+			set_symmetric_difference(outputList.begin(), outputList.end(), inputList.begin(), inputList.end(), back_inserter(temp));
+			outputList.swap(temp);
+		}
+
+		addOutputFault(Gate.at(a).gateOutput);
+	}
+
+	// Sets the stuck-at faults of an output node: the one opposite to its value is added, and
+	// neither can arrive through the inputs, which is possible when a fault loops back through a flip-flop
+	void addOutputFault(int a)
+	{
+		int fault = 0;
+
+		vector <int> &outputList = Node.at(a).nodeErrorList;
+
+		if (Node.at(a).SAvalue0 > 0)
+		{
+			outputList.erase(std::remove(outputList.begin(), outputList.end(), Node.at(a).SAvalue0), outputList.end());
+
+			if (a * 10 + Node.at(a).nodeValue != Node.at(a).SAvalue0)
+				fault = Node.at(a).SAvalue0;
+		}
+
+		if (Node.at(a).SAvalue1 > 0)
+		{
+			outputList.erase(std::remove(outputList.begin(), outputList.end(), Node.at(a).SAvalue1), outputList.end());
+
+			if (a * 10 + Node.at(a).nodeValue != Node.at(a).SAvalue1)
+				fault = Node.at(a).SAvalue1;
+		}
+
+		if (fault > 0)
+			outputList.insert(lower_bound(outputList.begin(), outputList.end(), fault), fault);
+	}
+
+private:
+
+	// The circuit, shared by all the jobs of a batch
+	string					&circuitName;
+	unsigned int			&netlistHash;
+	vector <Gates>			&Gate;
+	vector <Gates>			&FlipFlop;
+	vector <int>			&PINodes;
+	vector <int>			&PONodes;
+	vector <int>			&GONodes;
+	vector < vector <int> >	&listofGates;
+
+	// The state of one simulation
+	int		faultCount;										// Number of faults
+	int		faultPasses;									// Number of passes the fault locations are split into
+	int		faultChoice;									// Fault locations chosen in SAFaultList()
+
+	float	expFaultCoverage;								// The needed fault coverage
+
+	unsigned int vectorHash;								// Fingerprint of the input vectors applied in case 2
+
+	string	inputValues;									// Input test vector when manually entering the test case
+
+	vector <Nodes>		Node;
+	vector <int>		gateFlag;							// Flag indicating that the gate has been evaluated
+	vector <int>		driverGate;							// Gate driving each node after the ECO edits, -1 if none
+	vector <int>		faultList;							// List of faults
+	vector <int>		faultSites;							// List of fault location nodes
+	vector <Snapshots>	Snapshot;							// Node values and fault lists saved for every input vector in case 3
+};
+
+DeductiveFM::DeductiveFM(Circuits &circuit) :
+	circuitName(circuit.circuitName), netlistHash(circuit.netlistHash), Gate(circuit.Gate), FlipFlop(circuit.FlipFlop),
+	PINodes(circuit.PINodes), PONodes(circuit.PONodes), GONodes(circuit.GONodes), listofGates(circuit.listofGates)
 {
+	faultCount		 = 0;
+	faultPasses		 = 1;
+	faultChoice		 = 0;
+	expFaultCoverage = 0;
+	inputValues		 = "";
+	vectorHash		 = 2166136261u;
+
+	Node.assign(listofGates.size(), N);
+	gateFlag.assign(Gate.size(), 0);
 }
 
 DeductiveFM::~DeductiveFM()
 {
 }
 
+DeductiveFM DFM_Func(C);
+
+// Runs the jobs of a manifest file on a pool of threads for case 5
+// Every circuit is parsed once and shared, read-only, by its jobs; each job has its own DeductiveFM
+int runBatch(string manifestName, int threadCount)
+{
+	int nextJob = 0;
+
+	string line = "";
+
+	map <string, Circuits>	circuits;								// Parsed circuits by file name
+	map <string, int>		parseFlags;								// Result of parsing each circuit
+	vector <Jobs>			Job;
+	vector <int>			order;									// Order in which the jobs are taken up
+	vector <thread>			workers;
+	mutex					queueMutex;
+
+	ifstream manifestFile(manifestName + ".txt");
+
+	if (!manifestFile.is_open())
+		return 0;
+
+	// Each line is: <circuit file> <fault locations (1-5)> <input vector file | random:<count>>
+	while (getline(manifestFile, line))
+	{
+		istringstream iss(line);
+
+		if (!(iss >> J.netlist) || J.netlist[0] == '#')
+			continue;
+
+		if (!(iss >> J.faultChoice >> J.patterns))
+			return 2;
+
+		J.flag			 = 0;
+		J.vectorCount	 = 0;
+		J.faultsDetected = 0;
+		J.faultCount	 = 0;
+
+		Job.push_back(J);
+	}
+
+	manifestFile.close();
+
+	// Parsing every circuit once, before the workers start
+	for (int i = 0; i < Job.size(); i++)
+	{
+		if (parseFlags.count(Job.at(i).netlist) == 0)
+		{
+			DeductiveFM parser(circuits[Job.at(i).netlist]);
+			parseFlags[Job.at(i).netlist] = parser.parseCircuitFile(Job.at(i).netlist, 1);
+		}
+
+		Job.at(i).circuit = &circuits[Job.at(i).netlist];
+
+		// Only the jobs on circuits that were read are given to the workers
+		if (parseFlags[Job.at(i).netlist] == 0)
+			Job.at(i).flag = 0;
+		else if (parseFlags[Job.at(i).netlist] == 4)
+			Job.at(i).flag = 5;
+		else
+			order.push_back(i);
+	}
+
+	// Taking up the largest circuits first so that the threads finish together
+	for (int i = 1; i < order.size(); i++)
+		for (int j = i; j > 0 && Job.at(order.at(j)).circuit->Gate.size() > Job.at(order.at(j - 1)).circuit->Gate.size(); j--)
+			swap(order.at(j), order.at(j - 1));
+
+	if (threadCount <= 0)
+		threadCount = thread::hardware_concurrency();
+	threadCount = max(1, min(threadCount, (int) order.size()));
+
+	for (int t = 0; t < threadCount; t++)
+		workers.push_back(thread([&]()
+		{
+			while (true)
+			{
+				int a = 0;
+
+				{
+					lock_guard <mutex> lock(queueMutex);
+
+					if (nextJob >= order.size())
+						return;
+					a = order.at(nextJob++);
+				}
+
+				DeductiveFM simulation(*Job.at(a).circuit);
+				Job.at(a).flag = simulation.runJob(Job.at(a));
+			}
+		}));
+
+	for (int t = 0; t < workers.size(); t++)
+		workers.at(t).join();
+
+	// Consolidated report of all the jobs
+	ofstream reportFile("BatchReport.txt");
+
+	cout << endl << Job.size() << " jobs on " << circuits.size() << " circuits using " << threadCount << " threads" << endl;
+	reportFile << Job.size() << " jobs on " << circuits.size() << " circuits using " << threadCount << " threads" << endl;
+
+	for (int i = 0; i < Job.size(); i++)
+	{
+		ostringstream oss;
+
+		oss << endl << (i + 1) << ". " << Job.at(i).netlist << ", faults at " << Job.at(i).faultChoice << ", " << Job.at(i).patterns << " : ";
+
+		if (Job.at(i).flag == 1)
+		{
+			oss << Job.at(i).faultsDetected << " out of " << Job.at(i).faultCount << " faults detected by " << Job.at(i).vectorCount << " input vectors";
+			if (Job.at(i).faultCount > 0)
+				oss << ", fault coverage : " << (Job.at(i).faultsDetected * 100) / Job.at(i).faultCount;
+		}
+		else if (Job.at(i).flag == 0)
+			oss << "File not found!";
+		else if (Job.at(i).flag == 2)
+			oss << "Incorrect choice of fault locations";
+		else if (Job.at(i).flag == 3)
+			oss << "Input vector file not found!";
+		else if (Job.at(i).flag == 4)
+			oss << "Incorrect no. of inputs";
+		else
+			oss << "Incorrect gate in the circuit file";
+
+		cout << oss.str();
+		reportFile << oss.str();
+	}
+
+	reportFile.close();
+	return 1;
+}
+
 int main()
 {
 	int flag1 = 1, flag2 = 1, flag3 = 1;
 	int choice1 = 0, choice2 = 0;
+	int checkpointInterval = 0, resume = 0;
+	int budget = 0;
+	int threadCount = 0;
+	char ans = 'n';
+
+	string manifestName = "";
 
 	cout << endl << "What do you wish to do?";
 	cout << endl << "1. Analyse by giving individual test vectors";
 	cout << endl << "2. Obtain a specific fault coverage (in %)";
-	cout << endl << endl << "Choose one of the options (1 or 2): ";
+	cout << endl << "3. Re-simulate the saved test vectors after editing gates (ECO)";
+	cout << endl << "4. Simulate an input sequence over clock cycles (sequential circuits)";
+	cout << endl << "5. Run a batch of jobs from a manifest file";
+	cout << endl << endl << "Choose one of the options (1/2/3/4/5): ";
 	cin  >> choice1;
 
-	if (choice1 != 1 && choice1 != 2)
+	if (choice1 != 1 && choice1 != 2 && choice1 != 3 && choice1 != 4 && choice1 != 5)
 	{
 		cout << endl << "Incorrect choice!";
 		cout << endl << endl;
 		return 0;
 	}
 
+	// Choice 5: Batch of jobs
+	if (choice1 == 5)
+	{
+		cout << endl << "Enter the manifest file (without .txt): ";
+		cin  >> manifestName;
+
+		cout << endl << "Number of threads (0 for all the cores): ";
+		cin  >> threadCount;
+
+		flag1 = runBatch(manifestName, threadCount);
+		if (flag1 == 0)
+			cout << endl << "File not found!";
+		else if (flag1 == 2)
+			cout << endl << "Incorrect line in the manifest file";
+
+		cout << endl << endl;
+		return 0;
+	}
+
 	flag1 = DFM_Func.readCircuitFile(choice1);
 	if (flag1 == 0)
 	{
@@ -743,6 +2183,12 @@ int main()
 		cout << endl << endl;
 		return 0;
 	}
+	else if (flag1 == 4)
+	{
+		cout << endl << "Incorrect gate in the circuit file";
+		cout << endl << endl;
+		return 0;
+	}
 
 	cout << endl << "At which nodes do you want the faults to be considered?";
 	cout << endl << "1. Only Primary Inputs (PI)";
@@ -763,6 +2209,34 @@ int main()
 		return 0;
 	}
 
+	// Splitting the faults into passes to limit the memory
+	if (choice1 == 1 || choice1 == 2)
+	{
+		cout << endl << "Memory budget for the fault lists in KB (0 for no limit): ";
+		cin  >> budget;
+
+		DFM_Func.planPasses(budget, choice1);
+	}
+
+	// Checkpointing the fault coverage run
+	if (choice1 == 2)
+	{
+		cout << endl << "Save a checkpoint every how many input vectors? (0 for never): ";
+		cin  >> checkpointInterval;
+
+		cout << endl << "Resume from the last checkpoint (y/n): ";
+		cin  >> ans;
+
+		if (ans != 'y' && ans != 'n')
+		{
+			cout << endl << "Incorrect choice!";
+			cout << endl << endl;
+			return 0;
+		}
+
+		resume = (ans == 'y') ? 1 : 0;
+	}
+
 	switch (choice1)
 	{
 	case 1:
@@ -773,7 +2247,35 @@ int main()
 			cout << endl << "Incorrect choice";
 		break;
 	case 2:
-		DFM_Func.createOutputFile_FC();
+		flag3 = DFM_Func.createOutputFile_FC(checkpointInterval, resume);
+		if (flag3 == 0)
+			cout << endl << "Checkpoint not found!";
+		else if (flag3 == 2)
+			cout << endl << "Checkpoint is damaged or does not match the circuit and fault coverage";
+		break;
+	case 3:
+		flag3 = DFM_Func.createOutputFile_ECO();
+		if (flag3 == 0)
+			cout << endl << "Input vector file not found!";
+		else if (flag3 == 2)
+			cout << endl << "Gate edit file not found!";
+		else if (flag3 == 3)
+			cout << endl << "Incorrect gate edit";
+		else if (flag3 == 4)
+			cout << endl << "Incorrect no. of inputs";
+		else if (flag3 == 5)
+			cout << endl << "A node is left undriven or in a loop by the edits";
+		else if (flag3 == 6)
+			cout << endl << "No input vectors in the file";
+		break;
+	case 4:
+		flag3 = DFM_Func.createOutputFile_SEQ();
+		if (flag3 == 0)
+			cout << endl << "Input sequence file not found!";
+		else if (flag3 == 4)
+			cout << endl << "Incorrect no. of inputs";
+		else if (flag3 == 5)
+			cout << endl << "The circuit has a loop without a flip-flop";
 		break;
 	default:
 		cout << endl << "Incorrect choice!";